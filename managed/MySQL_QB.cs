@@ -1,4 +1,6 @@
 using System.Collections;
+using System.Globalization;
+using System.Text;
 using System.Text.Json;
 using static SwiftlyS2.API.Scripting.Database;
 
@@ -9,6 +11,8 @@ namespace SwiftlyS2.API.Extensions
         private static readonly string[] oldServerVersions = ["5.0", "5.1", "5.2", "5.3", "5.4", "5.5", "5.6", "5.7", "8.0"];
         private static readonly Dictionary<string, bool> oldServerCache = [];
         private static readonly Dictionary<string, Dictionary<string, string>> defaultValuesCacheTbl = [];
+        private const string bulkLoadPrefix = "LOAD DATA LOCAL INFILE 'swiftly:memory'";
+        private const string bulkLoadMarker = "/*swiftly:bulkload ";
 
         private DB? m_db;
         private string tableName = "";
@@ -24,6 +28,7 @@ namespace SwiftlyS2.API.Extensions
         private bool isDistinct = false;
         private int limitCount = -1;
         private int offsetCount = -1;
+        private StringBuilder? bulkData = null;
 
         private string FormatSQLValue(object? value)
         {
@@ -45,6 +50,42 @@ namespace SwiftlyS2.API.Extensions
             return value.ToString() ?? "NULL";
         }
 
+        private static void AppendBulkValue(StringBuilder sb, object? value)
+        {
+            if (value == null)
+            {
+                sb.Append("\\N");
+                return;
+            }
+
+            string str;
+            if (value is string s)
+                str = s;
+            else if (value is IDictionary || value is IEnumerable)
+                str = JsonSerializer.Serialize(value);
+            else if (value is bool b)
+                str = b ? "1" : "0";
+            else if (value is DateTime dt)
+                str = dt.ToString("yyyy-MM-dd HH:mm:ss", CultureInfo.InvariantCulture);
+            else if (value is IFormattable f)
+                str = f.ToString(null, CultureInfo.InvariantCulture);
+            else
+                str = value.ToString() ?? "";
+
+            foreach (var c in str)
+            {
+                switch (c)
+                {
+                    case '\\': sb.Append("\\\\"); break;
+                    case '\t': sb.Append("\\t"); break;
+                    case '\n': sb.Append("\\n"); break;
+                    case '\r': sb.Append("\\r"); break;
+                    case '\0': sb.Append("\\0"); break;
+                    default: sb.Append(c); break;
+                }
+            }
+        }
+
         private class Rule
         {
             public string Name { get; set; } = "";
@@ -258,6 +299,7 @@ namespace SwiftlyS2.API.Extensions
             if (string.IsNullOrEmpty(tableName))
                 throw new ArgumentException("Table name must be set before executing the query.");
 
+            bulkData = null;
             if (columns == null || columns.Length == 0)
                 query = "SELECT * FROM " + tableName;
             else
@@ -298,9 +340,47 @@ namespace SwiftlyS2.API.Extensions
                 }
             }
 
+            bulkData = null;
             query = "INSERT INTO " + tableName + " (" + string.Join(", ", cols) + ") VALUES (" + string.Join(", ", vals) + ")";
             return this;
 
+        }
+        // Loads the rows through LOAD DATA LOCAL INFILE, the server needs local_infile=ON.
+        // Like INSERT IGNORE, rows hitting a duplicate key are skipped and bad values are truncated instead of failing.
+        // The result's first row holds affectedRows, skippedRows and warningCounts, the next rows hold the first warnings.
+        public QueryBuilderMySQL BulkInsert(string[] columns, IEnumerable<object?[]> rows)
+        {
+            if (string.IsNullOrEmpty(tableName))
+                throw new ArgumentException("Table name must be set before executing the query.");
+
+            if (columns == null || columns.Length == 0)
+                throw new ArgumentException("BulkInsert requires at least one column.");
+
+            if (rows == null)
+                throw new ArgumentException("BulkInsert requires at least one row.");
+
+            var data = new StringBuilder();
+            foreach (var row in rows)
+            {
+                if (row == null || row.Length != columns.Length)
+                    throw new ArgumentException("BulkInsert requires every row to have one value per column.");
+
+                for (int i = 0; i < columns.Length; i++)
+                {
+                    if (i != 0)
+                        data.Append('\t');
+                    AppendBulkValue(data, row[i]);
+                }
+                data.Append('\n');
+            }
+
+            if (data.Length == 0)
+                throw new ArgumentException("BulkInsert requires at least one row.");
+
+            query = bulkLoadPrefix + " INTO TABLE " + tableName + " CHARACTER SET utf8mb4 (" + string.Join(", ", columns) + ")";
+            bulkData = data;
+            return this;
+
         }
         public QueryBuilderMySQL Update(Dictionary<string, object> values)
         {
@@ -311,6 +391,7 @@ namespace SwiftlyS2.API.Extensions
                 throw new ArgumentException("Update requires at least one column-value pair.");
 
             var updates = values.Select(kv => kv.Key + " = " + FormatSQLValue(kv.Value));
+            bulkData = null;
             query = "UPDATE " + tableName + " SET " + string.Join(", ", updates);
             return this;
 
@@ -320,6 +401,7 @@ namespace SwiftlyS2.API.Extensions
             if (string.IsNullOrEmpty(tableName))
                 throw new ArgumentException("Table name must be set before executing the query.");
 
+            bulkData = null;
             query = "DELETE FROM " + tableName;
             return this;
 
@@ -389,6 +471,7 @@ namespace SwiftlyS2.API.Extensions
                     definitions.Add(cr.ColumnName + " " + typ);
             }
 
+            bulkData = null;
             query = "CREATE TABLE IF NOT EXISTS " + tableName + " (" + string.Join(", ", definitions) + ")";
 
             return this;
@@ -429,6 +512,7 @@ namespace SwiftlyS2.API.Extensions
             if (definitions.Count == 0)
                 throw new ArgumentException("Alter requires at least one added or one removed column.");
 
+            bulkData = null;
             query = "ALTER TABLE " + tableName + " " + string.Join(", ", definitions);
             return this;
 
@@ -438,6 +522,7 @@ namespace SwiftlyS2.API.Extensions
             if (string.IsNullOrEmpty(tableName))
                 throw new ArgumentException("Table name must be set before executing the query.");
 
+            bulkData = null;
             query = "DROP TABLE IF EXISTS " + tableName;
             return this;
 
@@ -488,6 +573,17 @@ namespace SwiftlyS2.API.Extensions
         }
         private string PrepareQuery()
         {
+            if (bulkData != null)
+            {
+                if (joinClauses.Count > 0 || whereClauses.Count > 0 || orWhereClauses.Count > 0 || groupByClauses.Count > 0 ||
+                    havingClauses.Count > 0 || orderByClauses.Count > 0 || onDuplicateClauses.Count > 0 ||
+                    unionClauses.Count > 0 || limitCount >= 0 || offsetCount >= 0 || isDistinct)
+                    throw new ArgumentException("BulkInsert can't be combined with Join, Where, GroupBy, Having, OrderBy, Limit, Offset, OnDuplicate, Union or Distinct.");
+
+                var data = bulkData.ToString();
+                return bulkLoadMarker + Encoding.UTF8.GetByteCount(data) + "*/" + query + "\n" + data;
+            }
+
             var finalStr = query;
 
             if (!string.IsNullOrEmpty(finalStr) && finalStr.StartsWith("SELECT", StringComparison.OrdinalIgnoreCase) && isDistinct)
@@ -13,6 +13,16 @@ local oldServerVersions = {
 local oldServerCache = {}
 local defaultValuesCacheTbl = {}
 
+local bulkLoadPrefix = "LOAD DATA LOCAL INFILE 'swiftly:memory'"
+local bulkLoadMarker = "/*swiftly:bulkload "
+local bulkLoadEscapes = {
+    ["\\"] = "\\\\",
+    ["\t"] = "\\t",
+    ["\n"] = "\\n",
+    ["\r"] = "\\r",
+    ["\0"] = "\\0"
+}
+
 --- @param rule string
 --- @return table
 local function parseRule(rule)
@@ -182,6 +192,7 @@ function MySQL_QB(db)
     o.havingClauses = {}
     o.unionClauses = {}
     o.updatePairs = {}
+    o.bulkData = nil
     o.isDistinct = false
     o.limitCount = -1
     o.offsetCount = -1
@@ -200,6 +211,22 @@ function MySQL_QB(db)
         end
     end
 
+    --- @param value any
+    --- @return string
+    function o:FormatBulkValue(value)
+        if value == "nil" or value == nil then
+            return "\\N"
+        elseif type(value) == "table" then
+            return (json.encode(value):gsub("[\\\t\n\r\0]", bulkLoadEscapes))
+        elseif type(value) == "string" then
+            return (value:gsub("[\\\t\n\r\0]", bulkLoadEscapes))
+        elseif type(value) == "boolean" then
+            return value and "1" or "0"
+        else
+            return tostring(value)
+        end
+    end
+
     --- @param tblName string
     function o:Table(tblName)
         self.tableName = tblName
@@ -229,6 +256,7 @@ function MySQL_QB(db)
             end
         end
 
+        self.bulkData = nil
         self.query = "CREATE TABLE IF NOT EXISTS " .. self.tableName .. " (" .. table.concat(definitions, ", ") .. ")"
 
         return self
@@ -278,6 +306,7 @@ function MySQL_QB(db)
             return error("Alter requires at least one added or one removed column.")
         end
 
+        self.bulkData = nil
         self.query = "ALTER TABLE " .. self.tableName .. " " .. table.concat(definitions, ", ")
 
         return self
@@ -288,6 +317,7 @@ function MySQL_QB(db)
             return error("Table name must be set before executing the query.")
         end
 
+        self.bulkData = nil
         self.query = "DROP TABLE IF EXISTS " .. self.tableName
         return self
     end
@@ -298,6 +328,7 @@ function MySQL_QB(db)
             return error("Table name must be set before executing the query.")
         end
 
+        self.bulkData = nil
         if type(columns) ~= "table" or #columns == 0 then
             self.query = "SELECT * FROM " .. self.tableName
         else
@@ -337,12 +368,52 @@ function MySQL_QB(db)
             end
         end
 
+        self.bulkData = nil
         self.query = "INSERT INTO " ..
             self.tableName .. " (" .. table.concat(cols, ", ") .. ") VALUES (" .. table.concat(vals, ", ") .. ")"
 
         return self
     end
 
+    --- Loads the rows through LOAD DATA LOCAL INFILE, the server needs local_infile=ON.
+    --- Like INSERT IGNORE, rows hitting a duplicate key are skipped and bad values are truncated instead of failing.
+    --- The result's first row holds affectedRows, skippedRows and warningCounts, the next rows hold the first warnings.
+    --- @param columns table
+    --- @param rows table
+    function o:BulkInsert(columns, rows)
+        if self.tableName:len() <= 0 then
+            return error("Table name must be set before executing the query.")
+        end
+
+        if type(columns) ~= "table" or #columns == 0 then
+            return error("BulkInsert requires at least one column.")
+        end
+
+        if type(rows) ~= "table" or #rows == 0 then
+            return error("BulkInsert requires at least one row.")
+        end
+
+        local lines = {}
+
+        for i = 1, #rows do
+            if type(rows[i]) ~= "table" or #rows[i] ~= #columns then
+                return error("BulkInsert requires every row to be a list with one value per column, use \"nil\" for NULL.")
+            end
+
+            local fields = {}
+            for j = 1, #columns do
+                fields[j] = self:FormatBulkValue(rows[i][j])
+            end
+            lines[i] = table.concat(fields, "\t")
+        end
+
+        self.query = bulkLoadPrefix ..
+            " INTO TABLE " .. self.tableName .. " CHARACTER SET utf8mb4 (" .. table.concat(columns, ", ") .. ")"
+        self.bulkData = table.concat(lines, "\n") .. "\n"
+
+        return self
+    end
+
     --- @param values table
     function o:Update(values)
         if self.tableName:len() <= 0 then
@@ -359,6 +430,7 @@ function MySQL_QB(db)
             updates[#updates + 1] = k .. " = " .. o:FormatSQLValue(v)
         end
 
+        self.bulkData = nil
         self.query = "UPDATE " .. self.tableName .. " SET " .. table.concat(updates, ", ")
 
         return self
@@ -369,6 +441,7 @@ function MySQL_QB(db)
             return error("Table name must be set before executing the query.")
         end
 
+        self.bulkData = nil
         self.query = "DELETE FROM " .. self.tableName
 
         return self
@@ -494,6 +567,16 @@ function MySQL_QB(db)
     end
 
     function o:PrepareQuery()
+        if self.bulkData then
+            if #self.joinClauses > 0 or #self.whereClauses > 0 or #self.orWhereClauses > 0 or #self.groupByClauses > 0 or
+                #self.havingClauses > 0 or #self.orderByClauses > 0 or #self.onDuplicateClauses > 0 or
+                #self.unionClauses > 0 or self.limitCount >= 0 or self.offsetCount >= 0 or self.isDistinct then
+                return error("BulkInsert can't be combined with Join, Where, GroupBy, Having, OrderBy, Limit, Offset, OnDuplicate, Union or Distinct.")
+            end
+
+            return bulkLoadMarker .. #self.bulkData .. "*/" .. self.query .. "\n" .. self.bulkData
+        end
+
         local finalStr = self.query
 
         if self.query:find("^SELECT") ~= nil and self.isDistinct then
@@ -37,6 +37,11 @@ public:
     virtual void AddQueryQueue(DatabaseQueryQueue data) = 0;
 
     virtual const char* ProvideQueryBuilderTable() = 0;
+
+    // Streams an in-memory buffer to the server through a bulk load statement
+    // Requires local_infile=ON on the server (off by default since MySQL 8.0)
+    // Not reachable from scripts, the core's IDatabase does not declare it, scripts go through Query with a BulkInsert payload
+    virtual std::vector<std::map<std::string, std::any>> BulkLoad(const std::string& statement, const std::string& data) = 0;
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "MySQLDatabase.h"
 #include "../entrypoint.h"
 #include "../utils.h"
+#include <errmsg.h>
+#include <cstring>
 #include <thread>
 
 extern bool threadStarted;
@@ -15,6 +17,48 @@ void MySQLDatabase::SetConnectionConfig(std::map<std::string, std::string> conne
     m_database = connection_details["database"];
 }
 
+struct LocalInfileSource
+{
+    const char* data;
+    size_t length;
+    size_t offset;
+};
+
+static int LocalInfileInit(void** ptr, const char* filename, void* userdata)
+{
+    *ptr = userdata;
+    if (userdata == nullptr || strcmp(filename, BULKLOAD_SOURCE) != 0)
+        return 1;
+
+    return 0;
+}
+
+static int LocalInfileRead(void* ptr, char* buf, unsigned int buf_len)
+{
+    LocalInfileSource* source = (LocalInfileSource*)ptr;
+
+    size_t count = source->length - source->offset;
+    if (count == 0)
+        return 0;
+
+    if (count > buf_len)
+        count = buf_len;
+
+    memcpy(buf, source->data + source->offset, count);
+    source->offset += count;
+    return (int)count;
+}
+
+static void LocalInfileEnd(void* ptr)
+{
+}
+
+static int LocalInfileError(void* ptr, char* error_msg, unsigned int error_msg_len)
+{
+    snprintf(error_msg, error_msg_len, "Local files are not accessible, only in-memory bulk loads are allowed.");
+    return CR_UNKNOWN_ERROR;
+}
+
 bool MySQLDatabase::Connect()
 {
     if (this->connected)
@@ -40,6 +84,11 @@ bool MySQLDatabase::Connect()
     mysql_options(this->connection, MYSQL_OPT_READ_TIMEOUT, &timeout);
     mysql_options(this->connection, MYSQL_OPT_WRITE_TIMEOUT, &timeout);
 
+    // Local infile requests are only answered from in-memory buffers handed to BulkLoad, never from disk
+    unsigned int local_infile = 1;
+    mysql_options(this->connection, MYSQL_OPT_LOCAL_INFILE, &local_infile);
+    mysql_set_local_infile_handler(this->connection, LocalInfileInit, LocalInfileRead, LocalInfileEnd, LocalInfileError, nullptr);
+
     if (mysql_real_connect(this->connection, this->m_hostname.c_str(), this->m_username.c_str(), this->m_password.c_str(), this->m_database.c_str(), this->m_port, nullptr, 0) == nullptr)
     {
         this->Close(true);
@@ -119,21 +168,60 @@ std::any ParseFieldType(enum_field_types type, const char* value, uint32_t lengt
     }
 }
 
-std::vector<std::map<std::string, std::any>> MySQLDatabase::Query(std::any query)
+bool MySQLDatabase::PrepareConnection()
 {
-    const char* q = std::any_cast<const char*>(query);
-    std::lock_guard<std::mutex> lock(mtx);
-    std::vector<std::map<std::string, std::any>> values;
-
     if (!this->connected)
-        return {};
+        return false;
 
     if (mysql_ping(this->connection))
     {
         this->error = mysql_error(this->connection);
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<std::map<std::string, std::any>> MySQLDatabase::Query(std::any query)
+{
+    const char* q = std::any_cast<const char*>(query);
+
+    // Bulk loads carry the rows buffer length in their header, the buffer is streamed in place
+    if (strncmp(q, BULKLOAD_MARKER, strlen(BULKLOAD_MARKER)) == 0)
+    {
+        char* end = nullptr;
+        const char* header = q + strlen(BULKLOAD_MARKER);
+        unsigned long long dataLength = strtoull(header, &end, 10);
+        if (end == header || strncmp(end, "*/", 2) != 0)
+        {
+            this->error = "Malformed bulk load header.";
+            return {};
+        }
+
+        const char* statement = end + 2;
+        size_t available = strlen(statement);
+        if (dataLength >= available || statement[available - dataLength - 1] != '\n' || strncmp(statement, BULKLOAD_PREFIX, strlen(BULKLOAD_PREFIX)) != 0)
+        {
+            this->error = "Malformed bulk load payload.";
+            return {};
+        }
+
+        size_t statementLength = available - dataLength - 1;
+        return this->ExecuteBulkLoad(statement, statementLength, statement + statementLength + 1, dataLength);
+    }
+
+    if (strncmp(q, BULKLOAD_PREFIX, strlen(BULKLOAD_PREFIX)) == 0)
+    {
+        this->error = "Bulk loads from '" BULKLOAD_SOURCE "' must be sent through BulkInsert.";
         return {};
     }
 
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<std::map<std::string, std::any>> values;
+
+    if (!this->PrepareConnection())
+        return {};
+
     mysql_set_character_set(this->connection, "utf8mb4");
     if (mysql_real_query(this->connection, q, strlen(q)))
     {
@@ -148,9 +236,9 @@ std::vector<std::map<std::string, std::any>> MySQLDatabase::Query(std::any query
 
         if (mysql_field_count(this->connection) == 0)
         {
-            value.insert(std::make_pair("warningCounts", (uint64)mysql_warning_count(this->connection)));
-            value.insert(std::make_pair("affectedRows", mysql_affected_rows(this->connection)));
-            value.insert(std::make_pair("insertId", mysql_insert_id(this->connection)));
+            value.insert(std::make_pair("warningCounts", (uint64_t)mysql_warning_count(this->connection)));
+            value.insert(std::make_pair("affectedRows", (uint64_t)mysql_affected_rows(this->connection)));
+            value.insert(std::make_pair("insertId", (uint64_t)mysql_insert_id(this->connection)));
             values.push_back(value);
         }
         else
@@ -214,4 +302,74 @@ void MySQLDatabase::AddQueryQueue(DatabaseQueryQueue data)
 const char* MySQLDatabase::ProvideQueryBuilderTable()
 {
     return "MySQL_QB";
+}
+
+std::vector<std::map<std::string, std::any>> MySQLDatabase::BulkLoad(const std::string& statement, const std::string& data)
+{
+    return this->ExecuteBulkLoad(statement.c_str(), statement.size(), data.c_str(), data.size());
+}
+
+std::vector<std::map<std::string, std::any>> MySQLDatabase::ExecuteBulkLoad(const char* statement, size_t statementLength, const char* data, size_t length)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (!this->PrepareConnection())
+        return {};
+
+    LocalInfileSource source{ data, length, 0 };
+    mysql_set_local_infile_handler(this->connection, LocalInfileInit, LocalInfileRead, LocalInfileEnd, LocalInfileError, &source);
+    int failed = mysql_real_query(this->connection, statement, statementLength);
+    mysql_set_local_infile_handler(this->connection, LocalInfileInit, LocalInfileRead, LocalInfileEnd, LocalInfileError, nullptr);
+
+    if (failed)
+    {
+        this->error = mysql_error(this->connection);
+        return {};
+    }
+
+    // LOAD DATA LOCAL behaves like IGNORE, rows failing a key or conversion are skipped and only reported in mysql_info
+    uint64_t skippedRows = 0;
+    const char* info = mysql_info(this->connection);
+    const char* skipped = info ? strstr(info, "Skipped: ") : nullptr;
+    if (skipped)
+        skippedRows = strtoull(skipped + strlen("Skipped: "), nullptr, 10);
+
+    std::vector<std::map<std::string, std::any>> values;
+    std::map<std::string, std::any> value;
+    unsigned int warningCount = mysql_warning_count(this->connection);
+    value.insert(std::make_pair("warningCounts", (uint64_t)warningCount));
+    value.insert(std::make_pair("affectedRows", (uint64_t)mysql_affected_rows(this->connection)));
+    value.insert(std::make_pair("skippedRows", skippedRows));
+    values.push_back(value);
+
+    // The first entry is the summary, followed by up to BULKLOAD_MAX_WARNINGS rows of SHOW WARNINGS
+    if (warningCount > 0)
+    {
+        std::string query = string_format("SHOW WARNINGS LIMIT %d", BULKLOAD_MAX_WARNINGS);
+        if (mysql_real_query(this->connection, query.c_str(), query.size()) == 0)
+        {
+            MYSQL_RES* result = mysql_use_result(this->connection);
+            if (result != nullptr)
+            {
+                MYSQL_ROW row;
+                MYSQL_FIELD* fields = mysql_fetch_fields(result);
+                int num_fields = mysql_num_fields(result);
+
+                while ((row = mysql_fetch_row(result))) {
+                    std::map<std::string, std::any> warning;
+                    unsigned long* lengths = mysql_fetch_lengths(result);
+
+                    for (int i = 0; i < num_fields; i++) {
+                        warning.insert({ fields[i].name, row[i] ? ParseFieldType(fields[i].type, row[i], lengths[i]) : nullptr });
+                    }
+
+                    values.push_back(warning);
+                }
+
+                mysql_free_result(result);
+            }
+        }
+    }
+
+    return values;
 }
\ No newline at end of file
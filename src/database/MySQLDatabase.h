@@ -9,6 +9,14 @@
 #include <mutex>
 #include <deque>
 
+// Pseudo file name used by bulk loads, only this one is served to the server and always from memory
+#define BULKLOAD_SOURCE "swiftly:memory"
+#define BULKLOAD_PREFIX "LOAD DATA LOCAL INFILE '" BULKLOAD_SOURCE "'"
+// Queued bulk loads are framed as BULKLOAD_MARKER <rows buffer byte length>*/<statement>\n<rows buffer>
+#define BULKLOAD_MARKER "/*swiftly:bulkload "
+// Maximum amount of warning rows returned after a bulk load
+#define BULKLOAD_MAX_WARNINGS 64
+
 class MySQLDatabase : public IDatabase
 {
 private:
@@ -25,6 +33,9 @@ private:
     const char* error = nullptr;
     std::string m_version;
 
+    bool PrepareConnection();
+    std::vector<std::map<std::string, std::any>> ExecuteBulkLoad(const char* statement, size_t statementLength, const char* data, size_t length);
+
 public:
     std::deque<DatabaseQueryQueue> queryQueue;
     void SetConnectionConfig(std::map<std::string, std::string> connection_details);
@@ -46,6 +57,8 @@ public:
     void AddQueryQueue(DatabaseQueryQueue data);
 
     const char* ProvideQueryBuilderTable();
+
+    std::vector<std::map<std::string, std::any>> BulkLoad(const std::string& statement, const std::string& data);
 };
 
 #endif
\ No newline at end of file